@@ -0,0 +1,265 @@
+// Microbenchmarks for the lab libraries. Each case is repeated several times
+// and the median is reported, so the output can serve as a regression
+// baseline between builds.
+//
+//   labs_bench [--csv] [--repeat N] [filter]
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "buffer_pool.h"
+#include "file_scanner.h"
+#include "philosopher_engine.h"
+#include "process_registry.h"
+#include "process_snapshot.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct Benchmark {
+    const char* name;
+    size_t iterations;
+    size_t bytesPerIteration;
+    // Runs `iterations` operations and returns the elapsed nanoseconds.
+    std::function<double(size_t iterations)> run;
+};
+
+double elapsedNanoseconds(Clock::time_point start) {
+    return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+}
+
+volatile size_t sink;
+
+double benchPoolCheckout(size_t iterations) {
+    BufferPool pool(1024, 5);
+    auto start = Clock::now();
+    for (size_t i = 0; i < iterations; i++) {
+        auto buffer = pool.getBuffer();
+        pool.returnBuffer(std::move(buffer));
+    }
+    return elapsedNanoseconds(start);
+}
+
+// Threads are started and parked before the clock starts, and each records
+// when its last phase completed, so thread creation and join are not timed.
+double benchBarrierPhase(size_t iterations) {
+    const size_t numThreads = 4;
+    Barrier barrier(numThreads, 1);
+    std::atomic<size_t> ready{ 0 };
+    std::atomic<bool> go{ false };
+    std::vector<Clock::time_point> finished(numThreads);
+    std::vector<std::thread> threads;
+
+    for (size_t t = 0; t < numThreads; t++) {
+        threads.emplace_back([&, t] {
+            ready++;
+            while (!go.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            for (size_t i = 0; i < iterations; i++) {
+                barrier.waitProducer();
+            }
+            finished[t] = Clock::now();
+        });
+    }
+    while (ready.load() < numThreads) {
+        std::this_thread::yield();
+    }
+
+    auto start = Clock::now();
+    go.store(true, std::memory_order_release);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    auto end = *std::max_element(finished.begin(), finished.end());
+    return std::chrono::duration<double, std::nano>(end - start).count();
+}
+
+double benchForkAcquire(size_t iterations) {
+    ForkTable forks(5);
+    auto start = Clock::now();
+    for (size_t i = 0; i < iterations; i++) {
+        int left = static_cast<int>(i % 5);
+        int right = static_cast<int>((i + 1) % 5);
+        forks.acquire(left, right, std::chrono::milliseconds(1000));
+        forks.release(left, right);
+    }
+    return elapsedNanoseconds(start);
+}
+
+const size_t SCAN_SIZE = 16 * 1024 * 1024;
+
+double benchScanKernel(size_t iterations) {
+    static std::vector<char> data = [] {
+        std::vector<char> bytes(SCAN_SIZE);
+        std::mt19937 gen(42);
+        for (auto& byte : bytes) {
+            byte = static_cast<char>(gen());
+        }
+        return bytes;
+    }();
+
+    auto start = Clock::now();
+    for (size_t i = 0; i < iterations; i++) {
+        sink = CountNonZeroBytes(data.data(), data.size());
+    }
+    return elapsedNanoseconds(start);
+}
+
+const size_t SNAPSHOT_PROCESSES = 10000;
+
+// Synthetic /proc/<pid>/stat contents for SNAPSHOT_PROCESSES processes, so
+// the parse cost is measured without the open/read/close syscalls.
+const std::vector<std::string>& statLines() {
+    static std::vector<std::string> lines = [] {
+        std::vector<std::string> result;
+        char line[512];
+        for (size_t i = 0; i < SNAPSHOT_PROCESSES; i++) {
+            std::snprintf(line, sizeof(line),
+                "%zu (worker-%zu) S 1 %zu %zu 0 -1 4194560 9916 11734 69 60 %zu 57 12 10 20 0 %zu 0 %zu "
+                "25018368 %zu 18446744073709551615 1 1 0 0 0 0 0 4096 1088 0 0 0 17 0 0 0 0 0 0 0 0 0 0 0 0 0 0\n",
+                i + 1, i, i + 1, i + 1, i * 7, i % 8 + 1, 1000 + i, 2000 + i);
+            result.push_back(line);
+        }
+        return result;
+    }();
+    return lines;
+}
+
+// One iteration parses a full 10k-process snapshot.
+double benchSnapshotParse(size_t iterations) {
+    ProcessTable table;
+    table.reserve(SNAPSHOT_PROCESSES);
+    const auto& lines = statLines();
+
+    auto start = Clock::now();
+    for (size_t i = 0; i < iterations; i++) {
+        table.clear();
+        for (const auto& line : lines) {
+            ParseProcStat(line, table);
+        }
+    }
+    sink = table.size();
+    return elapsedNanoseconds(start);
+}
+
+// One iteration diffs two 10k-process snapshots that differ by 1% spawned,
+// 1% exited and 10% changed rows.
+double benchSnapshotDiff(size_t iterations) {
+    ProcessTable before;
+    ProcessTable now;
+    for (uint32_t i = 0; i < SNAPSHOT_PROCESSES; i++) {
+        if (i % 100 != 0) {
+            before.append(i + 1, 1, 4, i, i, i, "worker");
+        }
+        if (i % 100 != 50) {
+            now.append(i + 1, 1, 4, i, i % 10 == 0 ? i + 1 : i, i, "worker");
+        }
+    }
+    ProcessDiff diff;
+
+    auto start = Clock::now();
+    for (size_t i = 0; i < iterations; i++) {
+        DiffProcessTables(before, now, diff);
+    }
+    sink = diff.changed.size();
+    return elapsedNanoseconds(start);
+}
+
+#ifdef _WIN32
+const char* spawnCommand = "cmd.exe /c exit";
+#else
+const char* spawnCommand = "true";
+#endif
+
+// Spawn until the child has been reaped (Linux) or its handles closed (Windows).
+double benchSpawnLatency(size_t iterations) {
+    ProcessRegistry registry;
+    auto start = Clock::now();
+    for (size_t i = 0; i < iterations; i++) {
+        uint32_t pid = registry.spawn(spawnCommand, false);
+        if (pid == 0) {
+            std::cerr << "spawn failed: " << LastSystemError() << '\n';
+            std::exit(1);
+        }
+        registry.release(pid);
+    }
+    return elapsedNanoseconds(start);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    bool csv = false;
+    int repeat = 5;
+    std::string filter;
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--csv") == 0) {
+            csv = true;
+        }
+        else if (std::strcmp(argv[i], "--repeat") == 0 && i + 1 < argc) {
+            repeat = std::max(1, std::atoi(argv[++i]));
+        }
+        else {
+            filter = argv[i];
+        }
+    }
+
+    const std::vector<Benchmark> benchmarks = {
+        { "pool_checkout", 100000, 0, benchPoolCheckout },
+        { "barrier_phase", 2000, 0, benchBarrierPhase },
+        { "fork_acquire", 100000, 0, benchForkAcquire },
+        { "scan_kernel", 4, SCAN_SIZE, benchScanKernel },
+        { "snapshot_parse", 20, 0, benchSnapshotParse },
+        { "snapshot_diff", 100, 0, benchSnapshotDiff },
+        { "spawn_latency", 20, 0, benchSpawnLatency },
+    };
+
+    if (csv) {
+        std::cout << "name,iterations,median_ns,min_ns,mb_per_s\n";
+    }
+    else {
+        std::cout << std::left << std::setw(16) << "benchmark" << std::right << std::setw(12) << "iterations"
+            << std::setw(16) << "median ns/op" << std::setw(16) << "min ns/op" << std::setw(12) << "MB/s" << '\n';
+    }
+
+    for (const auto& benchmark : benchmarks) {
+        if (!filter.empty() && std::string(benchmark.name).find(filter) == std::string::npos) {
+            continue;
+        }
+
+        benchmark.run(1); // warm-up
+        std::vector<double> samples;
+        for (int r = 0; r < repeat; r++) {
+            samples.push_back(benchmark.run(benchmark.iterations) / benchmark.iterations);
+        }
+        std::sort(samples.begin(), samples.end());
+        double median = samples[samples.size() / 2];
+        double best = samples.front();
+        double throughput = benchmark.bytesPerIteration ? benchmark.bytesPerIteration * 1e3 / median : 0.0;
+
+        if (csv) {
+            std::cout << benchmark.name << ',' << benchmark.iterations << ',' << std::fixed << std::setprecision(1)
+                << median << ',' << best << ',' << throughput << '\n';
+        }
+        else {
+            std::cout << std::left << std::setw(16) << benchmark.name << std::right << std::setw(12) << benchmark.iterations
+                << std::fixed << std::setprecision(1) << std::setw(16) << median << std::setw(16) << best
+                << std::setw(12) << throughput << '\n';
+        }
+    }
+
+    return 0;
+}
@@ -1,83 +1,156 @@
 #include <iostream>
+#include <fstream>
 #include <vector>
 #include <string>
+#ifdef _WIN32
 #include <Windows.h>
-#include <TlHelp32.h>
+#endif
+#include "process_registry.h"
+#include "process_snapshot.h"
+#include "resource_sampler.h"
 
-std::vector<PROCESS_INFORMATION> childProcesses;
+#ifdef _WIN32
+const char* childCommand = "notepad.exe";
+const char* clearCommand = "cls";
+#else
+const char* childCommand = "sleep 600";
+const char* clearCommand = "clear";
+#endif
+
+ProcessRegistry childProcesses;
+ResourceSampler usageSampler(childProcesses);
+UsageSortKey usageSortKey = UsageSortKey::Pid;
 bool keepHandles = true;
+ProcessSnapshotter systemSnapshot;
 
 void StartChildProcess() {
-    STARTUPINFO si;
-    ZeroMemory(&si, sizeof(si));
-    si.cb = sizeof(si);
-
-    std::wstring commandLine = L"notepad.exe";
-
-    PROCESS_INFORMATION pi;
-    if (CreateProcess(NULL, &commandLine[0], NULL, NULL, keepHandles, 0, NULL, NULL, &si, &pi)) {
-        childProcesses.push_back(pi);
-        std::cout << "Child process started with PID: " << pi.dwProcessId << "\n\n";
+    uint32_t pid = childProcesses.spawn(childCommand, keepHandles);
+    if (pid != 0) {
+        std::cout << "Child process started with PID: " << pid << "\n\n";
     }
     else {
-        DWORD errorCode = GetLastError();
+        unsigned long errorCode = LastSystemError();
         std::cout << "Child Process Start Error: " << errorCode << " error code\n\n";
     }
 }
 
 void TerminateChildProcesses() {
-    std::vector<PROCESS_INFORMATION> terminatedProcesses;
-
-    for (const auto& pi : childProcesses) {
-        HANDLE hProcess = OpenProcess(PROCESS_TERMINATE, FALSE, pi.dwProcessId);
-        if (hProcess) {
-            TerminateProcess(hProcess, 0);
-            CloseHandle(hProcess);
-            std::cout << "Child process with PID " << pi.dwProcessId << " terminated\n\n";
+    for (const auto& child : childProcesses.list()) {
+        if (childProcesses.terminate(child.pid)) {
+            std::cout << "Child process with PID " << child.pid << " terminated\n\n";
             if (!keepHandles) {
-                terminatedProcesses.push_back(pi);
+                childProcesses.release(child.pid);
             }
         }
         else {
-            std::cout << "Failed to terminate child process with PID " << pi.dwProcessId << "\n\n";
+            std::cout << "Failed to terminate child process with PID " << child.pid << "\n\n";
         }
     }
+}
 
-    if (!keepHandles) {
-        for (const auto& pi : terminatedProcesses) {
-            CloseHandle(pi.hProcess);
-            CloseHandle(pi.hThread);
-        }
-        childProcesses.erase(std::remove_if(childProcesses.begin(), childProcesses.end(), [&](const PROCESS_INFORMATION& p) {
-            return std::find_if(terminatedProcesses.begin(), terminatedProcesses.end(), [&](const PROCESS_INFORMATION& t) { return t.dwProcessId == p.dwProcessId; }) != terminatedProcesses.end();
-            }), childProcesses.end());
+void UpdateProcessList() {
+    system(clearCommand);
+    childProcesses.sample();
+    std::vector<ChildProcess> children = childProcesses.list();
+    std::cout << "List of processes (sorted by " << UsageSortKeyName(usageSortKey) << "):" << '\n';
+    if (children.empty()) {
+        std::cout << "Empty list\n\n";
+        return;
     }
+    SortByUsage(children, usageSortKey);
+    PrintUsageTable(std::cout, children);
+    std::cout << '\n';
 }
-void UpdateProcessList() {
-    system("cls");
-    std::cout << "List of processes:" << '\n';
-    int i = 0;
-    for (const auto& pi : childProcesses) {
-        i++;
-        DWORD exitCode;
-        GetExitCodeProcess(pi.hProcess, &exitCode);
-        std::string status = (exitCode == STILL_ACTIVE) ? "Executes" : "Completed";
-        std::cout << "PID: " << pi.dwProcessId << ", Status: " << status << "\n\n";
+
+void ChangeSortKey() {
+    int key;
+    std::cout << "Sort by: 0. PID  1. CPU time  2. Peak RSS  3. I/O bytes  4. Context switches: ";
+    std::cin >> key;
+    if (key < 0 || key > 4) {
+        std::cout << "Incorrect choice" << "\n\n";
+        return;
     }
-    if (i == 0) {
-        std::cout << "Empty list\n\n";
+    usageSortKey = static_cast<UsageSortKey>(key);
+    std::cout << "Sorting by " << UsageSortKeyName(usageSortKey) << "\n\n";
+}
+
+void ExportUsage() {
+    const char* fileName = "child_usage.csv";
+    std::ofstream file(fileName);
+    if (!file) {
+        std::cout << "Failed to open " << fileName << "\n\n";
+        return;
+    }
+    std::vector<ChildProcess> children = childProcesses.list();
+    SortByUsage(children, usageSortKey);
+    WriteUsageCsv(file, children);
+    std::cout << "Resource usage written to " << fileName << "\n\n";
+}
+
+void ChangeSamplingInterval() {
+    long long milliseconds;
+    std::cout << "Sampling interval in ms (current " << usageSampler.getInterval().count() << "): ";
+    std::cin >> milliseconds;
+    if (milliseconds <= 0) {
+        std::cout << "Incorrect interval" << "\n\n";
+        return;
     }
+    usageSampler.setInterval(std::chrono::milliseconds(milliseconds));
+    std::cout << "Sampling interval: " << milliseconds << " ms\n\n";
+}
+
+void PrintProcessRows(const char* title, const ProcessTable& table, const std::vector<uint32_t>& rows) {
+    const size_t maxRows = 20;
+    std::cout << title << ": " << rows.size() << '\n';
+    for (size_t i = 0; i < rows.size() && i < maxRows; i++) {
+        uint32_t row = rows[i];
+        std::cout << "  PID: " << table.pid[row] << ", Parent: " << table.parentPid[row]
+            << ", Threads: " << table.threadCount[row] << ", Name: " << table.name(row) << '\n';
+    }
+    if (rows.size() > maxRows) {
+        std::cout << "  ... and " << rows.size() - maxRows << " more" << '\n';
+    }
+}
+
+void ShowSystemSnapshot() {
+    if (!systemSnapshot.refresh()) {
+        std::cout << "System snapshot error: " << LastSystemError() << " error code\n\n";
+        return;
+    }
+
+    const ProcessTable& current = systemSnapshot.current();
+    std::cout << "System processes: " << current.size()
+        << " (capture " << systemSnapshot.captureMicroseconds() << " us, diff "
+        << systemSnapshot.diffMicroseconds() << " us)" << '\n';
+
+    if (!systemSnapshot.hasBaseline()) {
+        std::cout << "Baseline snapshot taken, the next one will show the changes\n\n";
+        return;
+    }
+
+    const ProcessDiff& diff = systemSnapshot.diff();
+    PrintProcessRows("Spawned", current, diff.spawned);
+    PrintProcessRows("Exited", systemSnapshot.previous(), diff.exited);
+    PrintProcessRows("Changed", current, diff.changed);
+    std::cout << '\n';
 }
 
 int main() {
+#ifdef _WIN32
     system("color F0");
     SetConsoleOutputCP(CP_UTF8);
+#endif
+    usageSampler.start();
     int choice;
     do {
         std::cout << "1. Start a child process" << '\n';
         std::cout << "2. Update the list of processes" << '\n';
         std::cout << "3. Terminate all child processes" << '\n';
         std::cout << "4. Change Descriptor Saving Mode" << '\n';
+        std::cout << "5. Show system process snapshot changes" << '\n';
+        std::cout << "6. Change the sort column of the process list" << '\n';
+        std::cout << "7. Export child resource usage as CSV" << '\n';
+        std::cout << "8. Change the resource sampling interval" << '\n';
         std::cout << "0. Exit" << '\n';
         std::cout << "Choose the Option: ";
         std::cin >> choice;
@@ -96,6 +169,18 @@ int main() {
             keepHandles = !keepHandles;
             std::cout << "Descriptor Persistence Mode: " << (keepHandles ? "On" : "Off") << "\n\n";
             break;
+        case 5:
+            ShowSystemSnapshot();
+            break;
+        case 6:
+            ChangeSortKey();
+            break;
+        case 7:
+            ExportUsage();
+            break;
+        case 8:
+            ChangeSamplingInterval();
+            break;
         case 0:
             break;
         default:
@@ -104,6 +189,7 @@ int main() {
 
     } while (choice != 0);
 
+    usageSampler.stop();
     TerminateChildProcesses();
 
     return 0;
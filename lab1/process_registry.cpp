@@ -0,0 +1,297 @@
+#include "process_registry.h"
+
+#include <algorithm>
+#include <cstring>
+
+#ifdef _WIN32
+#include <Psapi.h>
+#else
+#include <cerrno>
+#include <csignal>
+#include <cstdio>
+#include <fcntl.h>
+#include <spawn.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+extern char** environ;
+#endif
+
+#ifdef _WIN32
+
+namespace {
+
+uint64_t FileTimeToMicroseconds(const FILETIME& time) {
+    ULARGE_INTEGER value;
+    value.LowPart = time.dwLowDateTime;
+    value.HighPart = time.dwHighDateTime;
+    return value.QuadPart / 10;
+}
+
+void ReadUsage(ChildProcess& child) {
+    DWORD exitCode;
+    if (GetExitCodeProcess(child.info.hProcess, &exitCode) && exitCode != STILL_ACTIVE) {
+        child.running = false;
+        child.exitCode = static_cast<int>(exitCode);
+    }
+
+    // Times and counters stay readable after exit, so the last sample is final.
+    FILETIME creationTime, exitTime, kernelTime, userTime;
+    if (GetProcessTimes(child.info.hProcess, &creationTime, &exitTime, &kernelTime, &userTime)) {
+        child.usage.userTimeUs = FileTimeToMicroseconds(userTime);
+        child.usage.systemTimeUs = FileTimeToMicroseconds(kernelTime);
+    }
+
+    PROCESS_MEMORY_COUNTERS memory;
+    if (GetProcessMemoryInfo(child.info.hProcess, &memory, sizeof(memory))) {
+        child.usage.peakRssBytes = memory.PeakWorkingSetSize;
+    }
+
+    IO_COUNTERS io;
+    if (GetProcessIoCounters(child.info.hProcess, &io)) {
+        child.usage.readBytes = io.ReadTransferCount;
+        child.usage.writeBytes = io.WriteTransferCount;
+    }
+}
+
+} // namespace
+
+unsigned long LastSystemError() {
+    return GetLastError();
+}
+
+ProcessRegistry::~ProcessRegistry() {
+    for (auto& child : children) {
+        CloseHandle(child.info.hProcess);
+        CloseHandle(child.info.hThread);
+    }
+}
+
+uint32_t ProcessRegistry::spawn(const std::string& command, bool inheritHandles) {
+    std::wstring commandLine(command.begin(), command.end());
+
+    STARTUPINFOW si;
+    ZeroMemory(&si, sizeof(si));
+    si.cb = sizeof(si);
+
+    ChildProcess child;
+    if (!CreateProcessW(NULL, &commandLine[0], NULL, NULL, inheritHandles, 0, NULL, NULL, &si, &child.info)) {
+        return 0;
+    }
+    child.pid = child.info.dwProcessId;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    children.push_back(child);
+    return child.pid;
+}
+
+bool ProcessRegistry::terminate(uint32_t pid) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = std::find_if(children.begin(), children.end(), [pid](const ChildProcess& c) { return c.pid == pid; });
+    if (it == children.end()) {
+        return false;
+    }
+    return !it->running || TerminateProcess(it->info.hProcess, 0);
+}
+
+void ProcessRegistry::release(uint32_t pid) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = std::find_if(children.begin(), children.end(), [pid](const ChildProcess& c) { return c.pid == pid; });
+    if (it == children.end()) {
+        return;
+    }
+    CloseHandle(it->info.hProcess);
+    CloseHandle(it->info.hThread);
+    children.erase(it);
+}
+
+void ProcessRegistry::sample() {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto& child : children) {
+        if (child.running) {
+            ReadUsage(child);
+        }
+    }
+}
+
+#else
+
+namespace {
+
+ssize_t ReadProcFile(uint32_t pid, const char* name, std::vector<char>& buffer) {
+    char path[64];
+    std::snprintf(path, sizeof(path), "/proc/%u/%s", pid, name);
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return -1;
+    }
+    ssize_t length = read(fd, buffer.data(), buffer.size() - 1);
+    close(fd);
+    if (length > 0) {
+        buffer[length] = '\0';
+    }
+    return length;
+}
+
+// Stores the number following "key" at the start of a line of a
+// "key: value" style file such as /proc/<pid>/status. Leaves `value`
+// untouched if the key is missing, e.g. a zombie has no VmHWM line.
+bool FindValue(const char* text, const char* key, uint64_t& value) {
+    size_t keyLength = std::strlen(key);
+    for (const char* line = text; line != nullptr && *line; ) {
+        if (std::strncmp(line, key, keyLength) == 0) {
+            const char* p = line + keyLength;
+            while (*p == ' ' || *p == '\t') {
+                p++;
+            }
+            uint64_t parsed = 0;
+            while (*p >= '0' && *p <= '9') {
+                parsed = parsed * 10 + static_cast<uint64_t>(*p++ - '0');
+            }
+            value = parsed;
+            return true;
+        }
+        line = std::strchr(line, '\n');
+        if (line != nullptr) {
+            line++;
+        }
+    }
+    return false;
+}
+
+uint64_t TimevalToMicroseconds(const timeval& time) {
+    return static_cast<uint64_t>(time.tv_sec) * 1000000 + static_cast<uint64_t>(time.tv_usec);
+}
+
+void ReadUsage(ChildProcess& child, std::vector<char>& buffer) {
+    static const uint64_t ticksPerSecond = static_cast<uint64_t>(sysconf(_SC_CLK_TCK));
+
+    if (ReadProcFile(child.pid, "stat", buffer) > 0) {
+        // Skip "pid (comm)" -- comm may contain spaces, so find the last ')'.
+        const char* p = std::strrchr(buffer.data(), ')');
+        for (int field = 2; p != nullptr && field < 14; field++) {
+            p = std::strchr(p + 1, ' ');
+        }
+        if (p != nullptr) {
+            unsigned long long userTicks = 0, systemTicks = 0;
+            if (std::sscanf(p, " %llu %llu", &userTicks, &systemTicks) == 2) {
+                child.usage.userTimeUs = userTicks * 1000000 / ticksPerSecond;
+                child.usage.systemTimeUs = systemTicks * 1000000 / ticksPerSecond;
+            }
+        }
+    }
+
+    if (ReadProcFile(child.pid, "status", buffer) > 0) {
+        uint64_t peakKib;
+        if (FindValue(buffer.data(), "VmHWM:", peakKib)) {
+            child.usage.peakRssBytes = peakKib * 1024;
+        }
+        FindValue(buffer.data(), "voluntary_ctxt_switches:", child.usage.voluntarySwitches);
+        FindValue(buffer.data(), "nonvoluntary_ctxt_switches:", child.usage.involuntarySwitches);
+    }
+
+    if (ReadProcFile(child.pid, "io", buffer) > 0) {
+        FindValue(buffer.data(), "rchar:", child.usage.readBytes);
+        FindValue(buffer.data(), "wchar:", child.usage.writeBytes);
+    }
+}
+
+// Reaps the child if it has exited and replaces the sampled figures with the
+// exact totals from its rusage. I/O byte counts are not part of rusage, so
+// the last sampled values are kept. So is the peak RSS: posix_spawn runs the
+// child in the parent's address space until exec, and the kernel keeps that
+// high-water mark, so ru_maxrss is never below the parent's own RSS.
+bool Reap(ChildProcess& child, int options) {
+    int status = 0;
+    rusage usage;
+    if (wait4(static_cast<pid_t>(child.pid), &status, options, &usage) != static_cast<pid_t>(child.pid)) {
+        return false;
+    }
+
+    child.running = false;
+    child.exitCode = WIFEXITED(status) ? WEXITSTATUS(status) : 128 + WTERMSIG(status);
+    child.usage.userTimeUs = TimevalToMicroseconds(usage.ru_utime);
+    child.usage.systemTimeUs = TimevalToMicroseconds(usage.ru_stime);
+    child.usage.voluntarySwitches = static_cast<uint64_t>(usage.ru_nvcsw);
+    child.usage.involuntarySwitches = static_cast<uint64_t>(usage.ru_nivcsw);
+    return true;
+}
+
+} // namespace
+
+unsigned long LastSystemError() {
+    return static_cast<unsigned long>(errno);
+}
+
+ProcessRegistry::~ProcessRegistry() {
+    for (auto& child : children) {
+        if (child.running) {
+            Reap(child, WNOHANG);
+        }
+    }
+}
+
+uint32_t ProcessRegistry::spawn(const std::string& command, bool /*inheritHandles*/) {
+    std::string script = "exec " + command;
+    char shell[] = "/bin/sh";
+    char flag[] = "-c";
+    char* argv[] = { shell, flag, &script[0], nullptr };
+
+    pid_t pid;
+    int result = posix_spawn(&pid, "/bin/sh", nullptr, nullptr, argv, environ);
+    if (result != 0) {
+        errno = result;
+        return 0;
+    }
+
+    ChildProcess child;
+    child.pid = static_cast<uint32_t>(pid);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    children.push_back(child);
+    return child.pid;
+}
+
+bool ProcessRegistry::terminate(uint32_t pid) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = std::find_if(children.begin(), children.end(), [pid](const ChildProcess& c) { return c.pid == pid; });
+    if (it == children.end()) {
+        return false;
+    }
+    return !it->running || kill(static_cast<pid_t>(pid), SIGKILL) == 0;
+}
+
+void ProcessRegistry::release(uint32_t pid) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = std::find_if(children.begin(), children.end(), [pid](const ChildProcess& c) { return c.pid == pid; });
+    if (it == children.end()) {
+        return;
+    }
+    if (it->running) {
+        Reap(*it, 0);
+    }
+    children.erase(it);
+}
+
+void ProcessRegistry::sample() {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto& child : children) {
+        if (child.running) {
+            ReadUsage(child, readBuffer);
+            Reap(child, WNOHANG);
+        }
+    }
+}
+
+#endif
+
+std::vector<ChildProcess> ProcessRegistry::list() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return children;
+}
+
+size_t ProcessRegistry::size() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return children.size();
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#include <Windows.h>
+#endif
+
+// Resources consumed by a child so far. Fields a platform cannot report are
+// left at zero (Windows has no per-process context switch counter).
+struct ResourceUsage {
+    uint64_t userTimeUs = 0;
+    uint64_t systemTimeUs = 0;
+    uint64_t peakRssBytes = 0;
+    uint64_t readBytes = 0;
+    uint64_t writeBytes = 0;
+    uint64_t voluntarySwitches = 0;
+    uint64_t involuntarySwitches = 0;
+};
+
+struct ChildProcess {
+    uint32_t pid = 0;
+    bool running = true;
+    int exitCode = 0;
+    ResourceUsage usage;
+#ifdef _WIN32
+    PROCESS_INFORMATION info{};
+#endif
+};
+
+// Last error reported by the operating system (GetLastError / errno).
+unsigned long LastSystemError();
+
+// Owns the children started by lab1. All methods are thread-safe so the
+// resource sampler can run alongside the menu.
+class ProcessRegistry {
+public:
+    ProcessRegistry() = default;
+    ProcessRegistry(const ProcessRegistry&) = delete;
+    ProcessRegistry& operator=(const ProcessRegistry&) = delete;
+    ~ProcessRegistry();
+
+    // Starts `command` and returns its PID, or 0 on failure (see LastSystemError).
+    // `inheritHandles` is passed to CreateProcess; on Linux descriptors without
+    // FD_CLOEXEC are always inherited.
+    uint32_t spawn(const std::string& command, bool inheritHandles);
+
+    // Forcefully stops a child. Succeeds for children that already exited.
+    bool terminate(uint32_t pid);
+
+    // Forgets a terminated child and closes its handles.
+    void release(uint32_t pid);
+
+    // Collects exited children and refreshes the resource usage of all of them.
+    void sample();
+
+    std::vector<ChildProcess> list() const;
+    size_t size() const;
+
+private:
+    mutable std::mutex mutex;
+    std::vector<ChildProcess> children;
+#ifndef _WIN32
+    std::vector<char> readBuffer = std::vector<char>(4096);
+#endif
+};
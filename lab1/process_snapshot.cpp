@@ -0,0 +1,321 @@
+#include "process_snapshot.h"
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cstring>
+#include <cstdio>
+#include <numeric>
+
+#ifdef _WIN32
+#include <Windows.h>
+#include <TlHelp32.h>
+#else
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+void ProcessTable::clear() {
+    pid.clear();
+    parentPid.clear();
+    threadCount.clear();
+    startTime.clear();
+    cpuTicks.clear();
+    residentPages.clear();
+    nameOffset.clear();
+    nameLength.clear();
+    names.clear();
+}
+
+void ProcessTable::reserve(size_t rows) {
+    pid.reserve(rows);
+    parentPid.reserve(rows);
+    threadCount.reserve(rows);
+    startTime.reserve(rows);
+    cpuTicks.reserve(rows);
+    residentPages.reserve(rows);
+    nameOffset.reserve(rows);
+    nameLength.reserve(rows);
+    names.reserve(rows * 16);
+}
+
+void ProcessTable::append(uint32_t processId, uint32_t parent, uint32_t threads, uint64_t start,
+    uint64_t cpu, uint64_t resident, std::string_view processName) {
+    pid.push_back(processId);
+    parentPid.push_back(parent);
+    threadCount.push_back(threads);
+    startTime.push_back(start);
+    cpuTicks.push_back(cpu);
+    residentPages.push_back(resident);
+    nameOffset.push_back(static_cast<uint32_t>(names.size()));
+    nameLength.push_back(static_cast<uint32_t>(processName.size()));
+    names.append(processName);
+}
+
+ProcessSnapshotter::ProcessSnapshotter() : readBuffer(4096) {}
+
+bool ProcessSnapshotter::refresh() {
+    auto start = std::chrono::steady_clock::now();
+
+    // Capture into a staging table so a failure leaves previous() intact.
+    if (!capture(staging)) {
+        return false;
+    }
+    int next = currentIndex ^ 1;
+    storeSortedByPid(staging, tables[next]);
+    currentIndex = next;
+    snapshots++;
+
+    auto captured = std::chrono::steady_clock::now();
+    lastDiff.clear();
+    if (hasBaseline()) {
+        DiffProcessTables(previous(), current(), lastDiff);
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    captureTime = std::chrono::duration<double, std::micro>(captured - start).count();
+    diffTime = std::chrono::duration<double, std::micro>(end - captured).count();
+    return true;
+}
+
+namespace {
+
+// Skips `count` space-separated fields starting at `p`. Spaces are located
+// eight bytes at a time, since the byte loop dominated the parse cost.
+const char* skipFields(const char* p, const char* end, int count) {
+    if constexpr (std::endian::native == std::endian::little) {
+        const uint64_t ones = 0x0101010101010101ull;
+        const uint64_t low7 = 0x7f7f7f7f7f7f7f7full;
+        while (count > 0 && end - p >= 8) {
+            uint64_t word;
+            std::memcpy(&word, p, sizeof(word));
+            uint64_t spaces = word ^ (ones * ' ');
+            // High bit of each byte set exactly where the byte was a space.
+            uint64_t mask = ~(((spaces & low7) + low7) | spaces | low7);
+            // Sum the per-byte flags with a multiply; std::popcount becomes a
+            // library call when the target lacks a popcnt instruction.
+            int found = static_cast<int>(((mask >> 7) * ones) >> 56);
+            if (found < count) {
+                count -= found;
+                p += 8;
+                continue;
+            }
+            while (--count > 0) {
+                mask &= mask - 1;
+            }
+            return p + std::countr_zero(mask) / 8 + 1;
+        }
+    }
+    while (count > 0 && p < end) {
+        if (*p++ == ' ') {
+            count--;
+        }
+    }
+    return p;
+}
+
+// Parses an unsigned decimal field and steps over the delimiter after it.
+// Returns false if there is no digit, e.g. when the line ended early.
+bool parseNumber(const char*& p, const char* end, uint64_t& value) {
+    if (p >= end || *p < '0' || *p > '9') {
+        return false;
+    }
+    value = 0;
+    while (p < end && *p >= '0' && *p <= '9') {
+        value = value * 10 + static_cast<uint64_t>(*p++ - '0');
+    }
+    if (p < end) {
+        p++;
+    }
+    return true;
+}
+
+} // namespace
+
+bool ParseProcStat(std::string_view stat, ProcessTable& table) {
+    // "pid (comm) state ppid ..." -- comm may itself contain spaces and
+    // parentheses, so it is delimited by the last ')'. The kernel caps comm
+    // at 64 bytes and no later field contains ')', so only that window is
+    // searched, with memchr rather than a byte-by-byte reverse scan.
+    const size_t maxCommLength = 64;
+    const char* begin = stat.data();
+    const char* end = begin + stat.size();
+    const char* open = static_cast<const char*>(std::memchr(begin, '(', stat.size()));
+    if (open == nullptr) {
+        return false;
+    }
+    const char* windowEnd = (std::min)(end, open + maxCommLength + 2);
+    const char* close = nullptr;
+    for (const char* p = open + 1; p < windowEnd; ) {
+        const char* next = static_cast<const char*>(std::memchr(p, ')', static_cast<size_t>(windowEnd - p)));
+        if (next == nullptr) {
+            break;
+        }
+        close = next;
+        p = next + 1;
+    }
+    if (close == nullptr || end - close < 2) {
+        return false;
+    }
+    size_t nameBegin = static_cast<size_t>(open - begin);
+    size_t nameEnd = static_cast<size_t>(close - begin);
+    std::string_view name = stat.substr(nameBegin + 1, nameEnd - nameBegin - 1);
+
+    const char* p = begin;
+    uint64_t pid, parent, userTicks, systemTicks, threads, start, resident;
+    if (!parseNumber(p, end, pid)) {
+        return false;
+    }
+    p = begin + nameEnd + 2;                                     // -> state (field 3)
+    p = skipFields(p, end, 1);                                   // -> ppid (field 4)
+    if (!parseNumber(p, end, parent)) {
+        return false;
+    }
+    p = skipFields(p, end, 9);                                   // -> utime (field 14)
+    if (!parseNumber(p, end, userTicks) || !parseNumber(p, end, systemTicks)) {
+        return false;
+    }
+    p = skipFields(p, end, 4);                                   // -> num_threads (field 20)
+    if (!parseNumber(p, end, threads)) {
+        return false;
+    }
+    p = skipFields(p, end, 1);                                   // -> starttime (field 22)
+    if (!parseNumber(p, end, start)) {
+        return false;
+    }
+    p = skipFields(p, end, 1);                                   // -> rss (field 24)
+    if (!parseNumber(p, end, resident)) {
+        return false;
+    }
+
+    table.append(static_cast<uint32_t>(pid), static_cast<uint32_t>(parent), static_cast<uint32_t>(threads),
+        start, userTicks + systemTicks, resident, name);
+    return true;
+}
+
+#ifdef _WIN32
+
+bool ProcessSnapshotter::capture(ProcessTable& table) {
+    table.clear();
+
+    HANDLE snapshot = CreateToolhelp32Snapshot(TH32CS_SNAPPROCESS, 0);
+    if (snapshot == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+
+    PROCESSENTRY32W entry;
+    entry.dwSize = sizeof(entry);
+    if (Process32FirstW(snapshot, &entry)) {
+        do {
+            int length = WideCharToMultiByte(CP_UTF8, 0, entry.szExeFile, -1,
+                readBuffer.data(), static_cast<int>(readBuffer.size()), NULL, NULL);
+            std::string_view name(readBuffer.data(), length > 0 ? length - 1 : 0);
+            table.append(entry.th32ProcessID, entry.th32ParentProcessID, entry.cntThreads,
+                0, 0, 0, name);
+        } while (Process32NextW(snapshot, &entry));
+    }
+
+    CloseHandle(snapshot);
+    return true;
+}
+
+#else
+
+namespace {
+
+uint32_t parsePid(const char* name) {
+    uint32_t value = 0;
+    for (; *name; ++name) {
+        if (*name < '0' || *name > '9') {
+            return 0;
+        }
+        value = value * 10 + static_cast<uint32_t>(*name - '0');
+    }
+    return value;
+}
+
+} // namespace
+
+bool ProcessSnapshotter::capture(ProcessTable& table) {
+    table.clear();
+
+    DIR* proc = opendir("/proc");
+    if (proc == nullptr) {
+        return false;
+    }
+    int procFd = dirfd(proc);
+
+    char path[sizeof(dirent::d_name) + 8];
+    while (dirent* entry = readdir(proc)) {
+        if (parsePid(entry->d_name) == 0) {
+            continue;
+        }
+
+        std::snprintf(path, sizeof(path), "%s/stat", entry->d_name);
+        int fd = openat(procFd, path, O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            continue; // exited between readdir and open
+        }
+        ssize_t length = read(fd, readBuffer.data(), readBuffer.size());
+        close(fd);
+        if (length <= 0) {
+            continue;
+        }
+
+        ParseProcStat(std::string_view(readBuffer.data(), static_cast<size_t>(length)), table);
+    }
+
+    closedir(proc);
+    return true;
+}
+
+#endif
+
+void ProcessSnapshotter::storeSortedByPid(ProcessTable& source, ProcessTable& target) {
+    // /proc is enumerated in PID order already, so this is normally a swap.
+    if (std::is_sorted(source.pid.begin(), source.pid.end())) {
+        std::swap(source, target);
+        return;
+    }
+
+    order.resize(source.size());
+    std::iota(order.begin(), order.end(), 0u);
+    std::sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) { return source.pid[a] < source.pid[b]; });
+
+    target.clear();
+    target.reserve(source.size());
+    for (uint32_t i : order) {
+        target.append(source.pid[i], source.parentPid[i], source.threadCount[i], source.startTime[i],
+            source.cpuTicks[i], source.residentPages[i], source.name(i));
+    }
+}
+
+void DiffProcessTables(const ProcessTable& before, const ProcessTable& now, ProcessDiff& diff) {
+    diff.clear();
+
+    // Both tables are sorted by PID, so a single merge pass classifies every row.
+    size_t i = 0;
+    size_t j = 0;
+    while (i < now.size() || j < before.size()) {
+        if (j == before.size() || (i < now.size() && now.pid[i] < before.pid[j])) {
+            diff.spawned.push_back(static_cast<uint32_t>(i++));
+        }
+        else if (i == now.size() || before.pid[j] < now.pid[i]) {
+            diff.exited.push_back(static_cast<uint32_t>(j++));
+        }
+        else {
+            // Same PID: a different start time or name means the PID was reused.
+            if (now.startTime[i] != before.startTime[j] || now.name(i) != before.name(j)) {
+                diff.exited.push_back(static_cast<uint32_t>(j));
+                diff.spawned.push_back(static_cast<uint32_t>(i));
+            }
+            else if (now.parentPid[i] != before.parentPid[j] || now.threadCount[i] != before.threadCount[j] ||
+                now.cpuTicks[i] != before.cpuTicks[j] || now.residentPages[i] != before.residentPages[j]) {
+                diff.changed.push_back(static_cast<uint32_t>(i));
+            }
+            i++;
+            j++;
+        }
+    }
+}
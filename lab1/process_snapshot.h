@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// System-wide process table stored as a structure of arrays, sorted by PID.
+// Names are packed into a single string and addressed by offset/length.
+// Fields a platform cannot report cheaply are left at zero.
+struct ProcessTable {
+    std::vector<uint32_t> pid;
+    std::vector<uint32_t> parentPid;
+    std::vector<uint32_t> threadCount;
+    std::vector<uint64_t> startTime;     // Linux: clock ticks since boot
+    std::vector<uint64_t> cpuTicks;      // Linux: user + system clock ticks
+    std::vector<uint64_t> residentPages; // Linux: resident set size in pages
+    std::vector<uint32_t> nameOffset;
+    std::vector<uint32_t> nameLength;
+    std::string names;
+
+    size_t size() const { return pid.size(); }
+
+    std::string_view name(size_t i) const {
+        return std::string_view(names).substr(nameOffset[i], nameLength[i]);
+    }
+
+    // Drops all rows but keeps the allocated capacity for the next snapshot.
+    void clear();
+    void reserve(size_t rows);
+    void append(uint32_t processId, uint32_t parent, uint32_t threads, uint64_t start,
+        uint64_t cpu, uint64_t resident, std::string_view processName);
+};
+
+// Result of comparing two consecutive snapshots.
+struct ProcessDiff {
+    std::vector<uint32_t> spawned; // row indices into the current table
+    std::vector<uint32_t> exited;  // row indices into the previous table
+    std::vector<uint32_t> changed; // row indices into the current table
+
+    void clear() {
+        spawned.clear();
+        exited.clear();
+        changed.clear();
+    }
+};
+
+// Parses one /proc/<pid>/stat line and appends it to `table`. Returns false,
+// appending nothing, if the line is malformed or ends before the rss field.
+bool ParseProcStat(std::string_view stat, ProcessTable& table);
+
+// Compares two PID-sorted tables and fills `diff` with the classified rows.
+void DiffProcessTables(const ProcessTable& before, const ProcessTable& now, ProcessDiff& diff);
+
+// Takes repeated snapshots of every process in the system and diffs each one
+// against the last. The tables are recycled between calls, so after the
+// first few refreshes no memory is allocated.
+class ProcessSnapshotter {
+public:
+    ProcessSnapshotter();
+
+    // Captures a new snapshot and diffs it against the previous one.
+    // Returns false if the process list could not be read; the previous
+    // snapshot and diff are then left untouched.
+    bool refresh();
+
+    bool hasBaseline() const { return snapshots > 1; }
+    const ProcessTable& current() const { return tables[currentIndex]; }
+    const ProcessTable& previous() const { return tables[currentIndex ^ 1]; }
+    const ProcessDiff& diff() const { return lastDiff; }
+
+    double captureMicroseconds() const { return captureTime; }
+    double diffMicroseconds() const { return diffTime; }
+
+private:
+    bool capture(ProcessTable& table);
+    void storeSortedByPid(ProcessTable& source, ProcessTable& target);
+
+    ProcessTable tables[2];
+    ProcessTable staging;
+    std::vector<uint32_t> order;
+    std::vector<char> readBuffer;
+    ProcessDiff lastDiff;
+    int currentIndex = 0;
+    size_t snapshots = 0;
+    double captureTime = 0.0;
+    double diffTime = 0.0;
+};
@@ -0,0 +1,157 @@
+#include "resource_sampler.h"
+
+#include <algorithm>
+#include <iomanip>
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+uint64_t CpuTime(const ChildProcess& child) {
+    return child.usage.userTimeUs + child.usage.systemTimeUs;
+}
+
+uint64_t IoBytes(const ChildProcess& child) {
+    return child.usage.readBytes + child.usage.writeBytes;
+}
+
+uint64_t ContextSwitches(const ChildProcess& child) {
+    return child.usage.voluntarySwitches + child.usage.involuntarySwitches;
+}
+
+void LowerCurrentThreadPriority() {
+#ifdef _WIN32
+    SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_BELOW_NORMAL);
+#else
+    // On Linux nice values are per thread when addressed by thread ID.
+    setpriority(PRIO_PROCESS, static_cast<id_t>(gettid()), 10);
+#endif
+}
+
+} // namespace
+
+const char* UsageSortKeyName(UsageSortKey key) {
+    switch (key) {
+    case UsageSortKey::Pid:
+        return "PID";
+    case UsageSortKey::CpuTime:
+        return "CPU time";
+    case UsageSortKey::PeakRss:
+        return "Peak RSS";
+    case UsageSortKey::IoBytes:
+        return "I/O bytes";
+    case UsageSortKey::ContextSwitches:
+        return "Context switches";
+    }
+    return "";
+}
+
+void SortByUsage(std::vector<ChildProcess>& children, UsageSortKey key) {
+    auto byKey = [key](const ChildProcess& a, const ChildProcess& b) {
+        switch (key) {
+        case UsageSortKey::CpuTime:
+            return CpuTime(a) > CpuTime(b);
+        case UsageSortKey::PeakRss:
+            return a.usage.peakRssBytes > b.usage.peakRssBytes;
+        case UsageSortKey::IoBytes:
+            return IoBytes(a) > IoBytes(b);
+        case UsageSortKey::ContextSwitches:
+            return ContextSwitches(a) > ContextSwitches(b);
+        default:
+            return a.pid < b.pid;
+        }
+    };
+    std::stable_sort(children.begin(), children.end(), byKey);
+}
+
+void PrintUsageTable(std::ostream& out, const std::vector<ChildProcess>& children) {
+    out << std::left << std::setw(10) << "PID" << std::setw(11) << "Status"
+        << std::right << std::setw(11) << "User ms" << std::setw(11) << "Sys ms"
+        << std::setw(12) << "Peak KiB" << std::setw(12) << "Read KiB" << std::setw(12) << "Write KiB"
+        << std::setw(10) << "Ctx sw" << '\n';
+    for (const auto& child : children) {
+        out << std::left << std::setw(10) << child.pid << std::setw(11) << (child.running ? "Executes" : "Completed")
+            << std::right << std::setw(11) << child.usage.userTimeUs / 1000
+            << std::setw(11) << child.usage.systemTimeUs / 1000
+            << std::setw(12) << child.usage.peakRssBytes / 1024
+            << std::setw(12) << child.usage.readBytes / 1024
+            << std::setw(12) << child.usage.writeBytes / 1024
+            << std::setw(10) << ContextSwitches(child) << '\n';
+    }
+}
+
+void WriteUsageCsv(std::ostream& out, const std::vector<ChildProcess>& children) {
+    out << "pid,running,exit_code,user_time_us,system_time_us,peak_rss_bytes,"
+        "read_bytes,write_bytes,voluntary_switches,involuntary_switches\n";
+    for (const auto& child : children) {
+        out << child.pid << ',' << (child.running ? 1 : 0) << ',' << child.exitCode << ','
+            << child.usage.userTimeUs << ',' << child.usage.systemTimeUs << ','
+            << child.usage.peakRssBytes << ',' << child.usage.readBytes << ','
+            << child.usage.writeBytes << ',' << child.usage.voluntarySwitches << ','
+            << child.usage.involuntarySwitches << '\n';
+    }
+}
+
+ResourceSampler::ResourceSampler(ProcessRegistry& registry, std::chrono::milliseconds interval)
+    : registry(registry), interval(interval) {}
+
+ResourceSampler::~ResourceSampler() {
+    stop();
+}
+
+void ResourceSampler::start() {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (running) {
+        return;
+    }
+    running = true;
+    worker = std::thread(&ResourceSampler::run, this);
+}
+
+void ResourceSampler::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!running) {
+            return;
+        }
+        running = false;
+        cv.notify_all();
+    }
+    worker.join();
+}
+
+void ResourceSampler::setInterval(std::chrono::milliseconds value) {
+    std::lock_guard<std::mutex> lock(mutex);
+    interval = value;
+    cv.notify_all();
+}
+
+std::chrono::milliseconds ResourceSampler::getInterval() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return interval;
+}
+
+void ResourceSampler::run() {
+    LowerCurrentThreadPriority();
+
+    std::unique_lock<std::mutex> lock(mutex);
+    while (running) {
+        lock.unlock();
+        registry.sample();
+        lock.lock();
+
+        // A changed interval restarts the wait, still measured from the last sample.
+        auto sampledAt = std::chrono::steady_clock::now();
+        while (running) {
+            auto current = interval;
+            if (!cv.wait_until(lock, sampledAt + current, [&] { return !running || interval != current; })) {
+                break;
+            }
+        }
+    }
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <ostream>
+#include <thread>
+#include <vector>
+
+#include "process_registry.h"
+
+enum class UsageSortKey {
+    Pid,
+    CpuTime,
+    PeakRss,
+    IoBytes,
+    ContextSwitches
+};
+
+const char* UsageSortKeyName(UsageSortKey key);
+
+// Orders children by PID ascending or by the chosen resource descending.
+void SortByUsage(std::vector<ChildProcess>& children, UsageSortKey key);
+
+void PrintUsageTable(std::ostream& out, const std::vector<ChildProcess>& children);
+void WriteUsageCsv(std::ostream& out, const std::vector<ChildProcess>& children);
+
+// Refreshes the usage of every registered child from a background thread.
+// The thread runs at reduced priority and only reads kernel counters, so the
+// children themselves are never stopped or signalled.
+class ResourceSampler {
+public:
+    explicit ResourceSampler(ProcessRegistry& registry,
+        std::chrono::milliseconds interval = std::chrono::milliseconds(1000));
+    ~ResourceSampler();
+
+    void start();
+    void stop();
+
+    void setInterval(std::chrono::milliseconds value);
+    std::chrono::milliseconds getInterval() const;
+
+private:
+    void run();
+
+    ProcessRegistry& registry;
+    std::thread worker;
+    mutable std::mutex mutex;
+    std::condition_variable cv;
+    std::chrono::milliseconds interval;
+    bool running = false;
+};
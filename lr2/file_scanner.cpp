@@ -0,0 +1,348 @@
+#include "file_scanner.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <future>
+#include <iostream>
+#include <vector>
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+size_t CountNonZeroBytes(const char* data, size_t size)
+{
+    // Branch-free so the compiler can vectorise the loop.
+    size_t count = 0;
+    for (size_t i = 0; i < size; i++)
+    {
+        count += data[i] != 0;
+    }
+    return count;
+}
+
+#ifdef _WIN32
+
+void CreateLargeFile(const std::filesystem::path& filePath, int64_t fileSize)
+{
+    HANDLE fileHandle = CreateFileW(filePath.c_str(), GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (fileHandle == INVALID_HANDLE_VALUE)
+    {
+        std::cout << "File creating error" << '\n';
+        return;
+    }
+
+    char* buffer = new char[1024 * 1024];
+    DWORD bytesWritten;
+    LONGLONG bytesRemaining = fileSize;
+
+    for (int i = 0; i < 1024 * 1024; i++)
+    {
+        buffer[i] = static_cast<char>(rand());
+    }
+
+    while (bytesRemaining > 0)
+    {
+        DWORD bytesToWrite = static_cast<DWORD>(std::min<LONGLONG>(bytesRemaining, 1024LL * 1024));
+        if (!WriteFile(fileHandle, buffer, bytesToWrite, &bytesWritten, NULL))
+        {
+            std::cout << "File input error" << '\n';
+            CloseHandle(fileHandle);
+            delete[] buffer;
+            return;
+        }
+
+        bytesRemaining -= bytesWritten;
+    }
+
+    CloseHandle(fileHandle);
+    delete[] buffer;
+    std::cout << "Large file successfully created" << '\n';
+}
+
+void ProcessFileAsync(const std::filesystem::path& filePath)
+{
+    HANDLE fileHandle = CreateFileW(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (fileHandle == INVALID_HANDLE_VALUE)
+    {
+        std::cout << "Error when openning file" << '\n';
+        return;
+    }
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(fileHandle, &fileSize))
+    {
+        std::cout << "Error getting size of file" << '\n';
+        CloseHandle(fileHandle);
+        return;
+    }
+
+    HANDLE fileMappingHandle = CreateFileMappingW(fileHandle, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (fileMappingHandle == NULL)
+    {
+        std::cout << "File display creation error" << '\n';
+        CloseHandle(fileHandle);
+        return;
+    }
+
+    LPVOID fileView = MapViewOfFile(fileMappingHandle, FILE_MAP_READ, 0, 0, 0);
+    if (fileView == NULL)
+    {
+        std::cout << "Memory File Display Error" << '\n';
+        CloseHandle(fileMappingHandle);
+        CloseHandle(fileHandle);
+        return;
+    }
+
+    UnmapViewOfFile(fileView);
+    CloseHandle(fileMappingHandle);
+    CloseHandle(fileHandle);
+}
+
+void ProcessFileSync(const std::filesystem::path& filePath)
+{
+    HANDLE fileHandle = CreateFileW(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (fileHandle == INVALID_HANDLE_VALUE)
+    {
+        std::cout << "File opening error" << '\n';
+        return;
+    }
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(fileHandle, &fileSize))
+    {
+        std::cout << "Error getting file size" << '\n';
+        CloseHandle(fileHandle);
+        return;
+    }
+
+    char* buffer = new char[fileSize.QuadPart];
+    DWORD bytesRead;
+    if (!ReadFile(fileHandle, buffer, static_cast<DWORD>(fileSize.QuadPart), &bytesRead, NULL))
+    {
+        std::cout << "File Read Error" << '\n';
+        delete[] buffer;
+        CloseHandle(fileHandle);
+        return;
+    }
+
+
+    delete[] buffer;
+    CloseHandle(fileHandle);
+}
+
+void ProcessFileMultiThreaded(const std::filesystem::path& filePath)
+{
+    HANDLE fileHandle = CreateFileW(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (fileHandle == INVALID_HANDLE_VALUE)
+    {
+        std::cout << "File opening error" << '\n';
+        return;
+    }
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(fileHandle, &fileSize))
+    {
+        std::cout << "Error getting file size" << '\n';
+        CloseHandle(fileHandle);
+        return;
+    }
+
+    const int numThreads = 4;
+    const LONGLONG chunkSize = fileSize.QuadPart / numThreads;
+    std::vector<std::future<void>> futures;
+    for (int i = 0; i < numThreads; i++)
+    {
+        LONGLONG offset = i * chunkSize;
+        LONGLONG size = (i == numThreads - 1) ? fileSize.QuadPart - offset : chunkSize;
+
+        futures.push_back(async(std::launch::async, [=]() {
+            HANDLE fileMapHandle = CreateFileMappingW(fileHandle, NULL, PAGE_READONLY, 0, 0, NULL);
+            if (fileMapHandle == NULL)
+            {
+                std::cout << "File display creation error" << '\n';
+                return;
+            }
+
+            LPVOID fileView = MapViewOfFile(fileMapHandle, FILE_MAP_READ, 0, offset, size);
+            if (fileView == NULL)
+            {
+                std::cout << "Memory File Display Error" << '\n';
+                CloseHandle(fileMapHandle);
+                return;
+            }
+
+            size_t charCount = CountNonZeroBytes(static_cast<char*>(fileView), static_cast<size_t>(size));
+            std::cout << "Num of symbols in range: " << charCount << "    Iteration:" << i + 1 << '\n';
+            UnmapViewOfFile(fileView);
+            CloseHandle(fileMapHandle);
+            }));
+    }
+
+    for (auto& fut : futures)
+    {
+        fut.get();
+    }
+
+    CloseHandle(fileHandle);
+}
+
+#else
+
+void CreateLargeFile(const std::filesystem::path& filePath, int64_t fileSize)
+{
+    int fd = open(filePath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0)
+    {
+        std::cout << "File creating error" << '\n';
+        return;
+    }
+
+    std::vector<char> buffer(1024 * 1024);
+    int64_t bytesRemaining = fileSize;
+
+    for (auto& byte : buffer)
+    {
+        byte = static_cast<char>(rand());
+    }
+
+    while (bytesRemaining > 0)
+    {
+        size_t bytesToWrite = static_cast<size_t>(std::min<int64_t>(bytesRemaining, static_cast<int64_t>(buffer.size())));
+        ssize_t bytesWritten = write(fd, buffer.data(), bytesToWrite);
+        if (bytesWritten < 0)
+        {
+            std::cout << "File input error" << '\n';
+            close(fd);
+            return;
+        }
+
+        bytesRemaining -= bytesWritten;
+    }
+
+    close(fd);
+    std::cout << "Large file successfully created" << '\n';
+}
+
+void ProcessFileAsync(const std::filesystem::path& filePath)
+{
+    int fd = open(filePath.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+    {
+        std::cout << "Error when openning file" << '\n';
+        return;
+    }
+
+    struct stat fileInfo;
+    if (fstat(fd, &fileInfo) != 0)
+    {
+        std::cout << "Error getting size of file" << '\n';
+        close(fd);
+        return;
+    }
+
+    void* fileView = mmap(nullptr, static_cast<size_t>(fileInfo.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    if (fileView == MAP_FAILED)
+    {
+        std::cout << "Memory File Display Error" << '\n';
+        close(fd);
+        return;
+    }
+    posix_madvise(fileView, static_cast<size_t>(fileInfo.st_size), POSIX_MADV_SEQUENTIAL);
+
+    munmap(fileView, static_cast<size_t>(fileInfo.st_size));
+    close(fd);
+}
+
+void ProcessFileSync(const std::filesystem::path& filePath)
+{
+    int fd = open(filePath.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+    {
+        std::cout << "File opening error" << '\n';
+        return;
+    }
+
+    struct stat fileInfo;
+    if (fstat(fd, &fileInfo) != 0)
+    {
+        std::cout << "Error getting file size" << '\n';
+        close(fd);
+        return;
+    }
+
+    std::vector<char> buffer(static_cast<size_t>(fileInfo.st_size));
+    size_t bytesRead = 0;
+    while (bytesRead < buffer.size())
+    {
+        ssize_t result = read(fd, buffer.data() + bytesRead, buffer.size() - bytesRead);
+        if (result <= 0)
+        {
+            std::cout << "File Read Error" << '\n';
+            close(fd);
+            return;
+        }
+        bytesRead += static_cast<size_t>(result);
+    }
+
+    close(fd);
+}
+
+void ProcessFileMultiThreaded(const std::filesystem::path& filePath)
+{
+    int fd = open(filePath.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+    {
+        std::cout << "File opening error" << '\n';
+        return;
+    }
+
+    struct stat fileInfo;
+    if (fstat(fd, &fileInfo) != 0)
+    {
+        std::cout << "Error getting file size" << '\n';
+        close(fd);
+        return;
+    }
+
+    const int numThreads = 4;
+    const int64_t pageSize = sysconf(_SC_PAGESIZE);
+    const int64_t chunkSize = fileInfo.st_size / numThreads;
+    std::vector<std::future<void>> futures;
+    for (int i = 0; i < numThreads; i++)
+    {
+        int64_t offset = i * chunkSize;
+        int64_t size = (i == numThreads - 1) ? fileInfo.st_size - offset : chunkSize;
+
+        futures.push_back(std::async(std::launch::async, [=]() {
+            // mmap offsets must be page aligned, so map from the preceding page boundary.
+            int64_t alignedOffset = offset - offset % pageSize;
+            size_t mappedSize = static_cast<size_t>(size + offset - alignedOffset);
+            void* fileView = mmap(nullptr, mappedSize, PROT_READ, MAP_PRIVATE, fd, alignedOffset);
+            if (fileView == MAP_FAILED)
+            {
+                std::cout << "Memory File Display Error" << '\n';
+                return;
+            }
+
+            const char* fileViewPtr = static_cast<const char*>(fileView) + (offset - alignedOffset);
+            size_t charCount = CountNonZeroBytes(fileViewPtr, static_cast<size_t>(size));
+            std::cout << "Num of symbols in range: " << charCount << "    Iteration:" << i + 1 << '\n';
+            munmap(fileView, mappedSize);
+            }));
+    }
+
+    for (auto& fut : futures)
+    {
+        fut.get();
+    }
+
+    close(fd);
+}
+
+#endif
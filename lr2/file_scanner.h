@@ -0,0 +1,16 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+
+const int64_t FILE_SIZE = 1LL * 1024 * 1024 * 1024;
+//const int64_t FILE_SIZE = 1LL * 1024 * 1024;
+
+void CreateLargeFile(const std::filesystem::path& filePath, int64_t fileSize = FILE_SIZE);
+void ProcessFileAsync(const std::filesystem::path& filePath);
+void ProcessFileSync(const std::filesystem::path& filePath);
+void ProcessFileMultiThreaded(const std::filesystem::path& filePath);
+
+// Scan kernel shared by the multi-threaded method: number of non-zero bytes.
+size_t CountNonZeroBytes(const char* data, size_t size);
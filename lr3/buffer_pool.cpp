@@ -0,0 +1,64 @@
+#include "buffer_pool.h"
+
+#include <algorithm>
+
+SharedBuffer::SharedBuffer(size_t size) : data(size) {}
+
+void SharedBuffer::writeData(const std::string& message) {
+    std::copy(message.begin(), message.end(), data.begin());
+}
+
+std::string SharedBuffer::readData() const {
+    return std::string(data.begin(), std::find(data.begin(), data.end(), '\0'));
+}
+
+BufferPool::BufferPool(size_t bufferSize, size_t poolSize)
+    : bufferSize(bufferSize), poolSize(poolSize) {
+    for (size_t i = 0; i < poolSize; ++i) {
+        returnBuffer(std::make_unique<SharedBuffer>(bufferSize));
+    }
+}
+
+std::unique_ptr<SharedBuffer> BufferPool::getBuffer() {
+    std::unique_lock<std::mutex> lock(mutex);
+    cv.wait(lock, [this] { return !availableBuffers.empty(); });
+    auto buffer = std::move(availableBuffers.front());
+    availableBuffers.pop();
+    return buffer;
+}
+
+void BufferPool::returnBuffer(std::unique_ptr<SharedBuffer> buffer) {
+    std::lock_guard<std::mutex> lock(mutex);
+    availableBuffers.push(std::move(buffer));
+    cv.notify_one();
+}
+
+Barrier::Barrier(std::size_t producerCount, std::size_t consumerCount)
+    : producerThreshold(producerCount), consumerThreshold(consumerCount),
+    producerCount(producerCount), consumerCount(consumerCount), generation(0) {}
+
+void Barrier::waitProducer() {
+    std::unique_lock<std::mutex> lock(mutex);
+    auto gen = generation;
+    if (--producerCount == 0) {
+        generation++;
+        producerCount = producerThreshold;
+        cv.notify_all();
+    }
+    else {
+        cv.wait(lock, [this, gen] { return gen != generation; });
+    }
+}
+
+void Barrier::waitConsumer() {
+    std::unique_lock<std::mutex> lock(mutex);
+    auto gen = generation;
+    if (--consumerCount == 0) {
+        generation++;
+        consumerCount = consumerThreshold;
+        cv.notify_all();
+    }
+    else {
+        cv.wait(lock, [this, gen] { return gen != generation; });
+    }
+}
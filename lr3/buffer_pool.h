@@ -0,0 +1,52 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <vector>
+
+class SharedBuffer {
+public:
+    explicit SharedBuffer(size_t size);
+
+    void writeData(const std::string& message);
+    std::string readData() const;
+
+private:
+    std::vector<char> data;
+};
+
+class BufferPool {
+public:
+    BufferPool(size_t bufferSize, size_t poolSize);
+
+    std::unique_ptr<SharedBuffer> getBuffer();
+    void returnBuffer(std::unique_ptr<SharedBuffer> buffer);
+
+private:
+    std::queue<std::unique_ptr<SharedBuffer>> availableBuffers;
+    std::mutex mutex;
+    std::condition_variable cv;
+    const size_t bufferSize;
+    const size_t poolSize;
+};
+
+class Barrier {
+public:
+    explicit Barrier(std::size_t producerCount, std::size_t consumerCount);
+
+    void waitProducer();
+    void waitConsumer();
+
+private:
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::size_t producerThreshold;
+    std::size_t consumerThreshold;
+    std::size_t producerCount;
+    std::size_t consumerCount;
+    std::size_t generation;
+};
@@ -1,9 +1,7 @@
 #include <iostream>
 #include <vector>
 #include <mutex>
-#include <condition_variable>
 #include <thread>
-#include <queue>
 #include <memory>
 #include <functional>
 #include <atomic>
@@ -11,7 +9,7 @@
 #include <sstream>
 #include <iomanip>
 #include <chrono>
-#include <barrier>
+#include "buffer_pool.h"
 
 std::mutex cout_mutex;
 
@@ -22,95 +20,6 @@ void synchronized_cout(T&& t) {
 }
 
 
-class SharedBuffer {
-public:
-    explicit SharedBuffer(size_t size) : data(size) {}
-
-    void writeData(const std::string& message) {
-        std::copy(message.begin(), message.end(), data.begin());
-    }
-
-    std::string readData() const {
-        return std::string(data.begin(), std::find(data.begin(), data.end(), '\0'));
-    }
-
-private:
-    std::vector<char> data;
-};
-
-class BufferPool {
-public:
-    BufferPool(size_t bufferSize, size_t poolSize)
-        : bufferSize(bufferSize), poolSize(poolSize) {
-        for (size_t i = 0; i < poolSize; ++i) {
-            returnBuffer(std::make_unique<SharedBuffer>(bufferSize));
-        }
-    }
-
-    std::unique_ptr<SharedBuffer> getBuffer() {
-        std::unique_lock<std::mutex> lock(mutex);
-        cv.wait(lock, [this] { return !availableBuffers.empty(); });
-        auto buffer = std::move(availableBuffers.front());
-        availableBuffers.pop();
-        return buffer;
-    }
-
-    void returnBuffer(std::unique_ptr<SharedBuffer> buffer) {
-        std::lock_guard<std::mutex> lock(mutex);
-        availableBuffers.push(std::move(buffer));
-        cv.notify_one();
-    }
-
-private:
-    std::queue<std::unique_ptr<SharedBuffer>> availableBuffers;
-    std::mutex mutex;
-    std::condition_variable cv;
-    const size_t bufferSize;
-    const size_t poolSize;
-};
-
-class Barrier {
-public:
-    explicit Barrier(std::size_t producerCount, std::size_t consumerCount)
-        : producerThreshold(producerCount), consumerThreshold(consumerCount),
-        producerCount(producerCount), consumerCount(consumerCount), generation(0) {}
-
-    void waitProducer() {
-        std::unique_lock<std::mutex> lock(mutex);
-        auto gen = generation;
-        if (--producerCount == 0) {
-            generation++;
-            producerCount = producerThreshold;
-            cv.notify_all();
-        }
-        else {
-            cv.wait(lock, [this, gen] { return gen != generation; });
-        }
-    }
-
-    void waitConsumer() {
-        std::unique_lock<std::mutex> lock(mutex);
-        auto gen = generation;
-        if (--consumerCount == 0) {
-            generation++;
-            consumerCount = consumerThreshold;
-            cv.notify_all();
-        }
-        else {
-            cv.wait(lock, [this, gen] { return gen != generation; });
-        }
-    }
-
-private:
-    std::mutex mutex;
-    std::condition_variable cv;
-    std::size_t producerThreshold;
-    std::size_t consumerThreshold;
-    std::size_t producerCount;
-    std::size_t consumerCount;
-    std::size_t generation;
-};
-
 class Process {
 public:
     using ProcessFunction = std::function<void(SharedBuffer&, const std::string&, Barrier&)>;
@@ -1,121 +1,18 @@
-#include <windows.h>
 #include <iostream>
 #include <vector>
-#include <random>
-#include <chrono>
+#include "philosopher_engine.h"
 
-const int MAX_PHILOSOPHERS = 10;
+void printResults(const DiningTable& table) {
+    const Config& config = table.getConfig();
 
-struct Philosopher {
-    int id;
-    HANDLE leftFork;
-    HANDLE rightFork;
-    int eatingCount;
-    int thinkingTime;
-    int eatingTime;
-    LONGLONG totalActiveTime;
-    LONGLONG totalBlockedTime;
-};
-
-struct Config {
-    int numPhilosophers;
-    int simulationTime;
-    int minThinkingTime;
-    int maxThinkingTime;
-    int minEatingTime;
-    int maxEatingTime;
-    int timeout;
-};
-
-Config config;
-std::vector<Philosopher> philosophers;
-std::vector<HANDLE> forks;
-HANDLE printMutex;
-bool running = true;
-
-void printStatus(const char* status, int id) {
-    WaitForSingleObject(printMutex, INFINITE);
-    std::cout << "Philosopher " << id << " " << status << std::endl;
-    ReleaseMutex(printMutex);
-}
-
-int getRandomTime(int min, int max) {
-    static std::random_device rd;
-    static std::mt19937 gen(rd());
-    std::uniform_int_distribution<> dis(min, max);
-    return dis(gen);
-}
-
-DWORD WINAPI philosopherThread(LPVOID param) {
-    Philosopher* phil = (Philosopher*)param;
-    LARGE_INTEGER startTime, endTime, frequency;
-    QueryPerformanceFrequency(&frequency);
-
-    while (running) {
-        int thinkingTime = getRandomTime(config.minThinkingTime, config.maxThinkingTime);
-        printStatus("is thinking", phil->id);
-        Sleep(thinkingTime);
-
-        QueryPerformanceCounter(&startTime);
-
-        HANDLE handles[2] = { phil->leftFork, phil->rightFork };
-        DWORD result = WaitForMultipleObjects(2, handles, TRUE, config.timeout);
-
-        if (result == WAIT_OBJECT_0) {
-            QueryPerformanceCounter(&endTime);
-            phil->totalBlockedTime += (endTime.QuadPart - startTime.QuadPart) * 1000 / frequency.QuadPart;
-
-            int eatingTime = getRandomTime(config.minEatingTime, config.maxEatingTime);
-            printStatus("is eating", phil->id);
-            Sleep(eatingTime);
-            phil->eatingCount++;
-
-            QueryPerformanceCounter(&startTime);
-            phil->totalActiveTime += eatingTime;
-
-            ReleaseMutex(phil->leftFork);
-            ReleaseMutex(phil->rightFork);
-
-            QueryPerformanceCounter(&endTime);
-            phil->totalActiveTime += (endTime.QuadPart - startTime.QuadPart) * 1000 / frequency.QuadPart;
-        }
-        else {
-            QueryPerformanceCounter(&endTime);
-            phil->totalBlockedTime += config.timeout;
-            printStatus("couldn't acquire forks", phil->id);
-        }
-    }
-
-    return 0;
-}
-
-void runSimulation() {
-    std::vector<HANDLE> threads;
-
-    for (int i = 0; i < config.numPhilosophers; i++) {
-        HANDLE thread = CreateThread(NULL, 0, philosopherThread, &philosophers[i], 0, NULL);
-        threads.push_back(thread);
-    }
-
-    Sleep(config.simulationTime * 1000);
-    running = false;
-
-    WaitForMultipleObjects(config.numPhilosophers, threads.data(), TRUE, INFINITE);
-
-    for (HANDLE thread : threads) {
-        CloseHandle(thread);
-    }
-}
-
-void printResults() {
     std::cout << "\nSimulation Results:\n";
     std::cout << "-------------------\n";
 
     int totalEatingCount = 0;
-    LONGLONG totalActiveTime = 0;
-    LONGLONG totalBlockedTime = 0;
+    long long totalActiveTime = 0;
+    long long totalBlockedTime = 0;
 
-    for (const auto& phil : philosophers) {
+    for (const auto& phil : table.getPhilosophers()) {
         std::cout << "Philosopher " << phil.id << ":\n";
         std::cout << "  Eating count: " << phil.eatingCount << "\n";
         std::cout << "  Active time: " << phil.totalActiveTime << " ms\n";
@@ -140,6 +37,7 @@ void printResults() {
 }
 
 int main() {
+    Config config;
     config.numPhilosophers = 5;
     config.simulationTime = 15;  
     config.minThinkingTime = 1000; 
@@ -148,32 +46,12 @@ int main() {
     config.maxEatingTime = 3000;
     config.timeout = 5000; 
 
-    for (int i = 0; i < config.numPhilosophers; i++) {
-        forks.push_back(CreateMutex(NULL, FALSE, NULL));
-    }
-
-    for (int i = 0; i < config.numPhilosophers; i++) {
-        Philosopher phil;
-        phil.id = i;
-        phil.leftFork = forks[i];
-        phil.rightFork = forks[(i + 1) % config.numPhilosophers];
-        phil.eatingCount = 0;
-        phil.totalActiveTime = 0;
-        phil.totalBlockedTime = 0;
-        philosophers.push_back(phil);
-    }
-
-    printMutex = CreateMutex(NULL, FALSE, NULL);
+    DiningTable table(config);
 
     std::cout << "Starting simulation for " << config.simulationTime << " seconds...\n";
-    runSimulation();
-
-    printResults();
+    table.runSimulation();
 
-    for (HANDLE fork : forks) {
-        CloseHandle(fork);
-    }
-    CloseHandle(printMutex);
+    printResults(table);
 
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,113 @@
+#include "philosopher_engine.h"
+
+#include <iostream>
+#include <random>
+#include <thread>
+
+namespace {
+
+int getRandomTime(int min, int max) {
+    static std::random_device rd;
+    static std::mt19937 gen(rd());
+    static std::mutex genMutex;
+    std::uniform_int_distribution<> dis(min, max);
+    std::lock_guard<std::mutex> lock(genMutex);
+    return dis(gen);
+}
+
+long long elapsedMilliseconds(std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end) {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+}
+
+} // namespace
+
+ForkTable::ForkTable(int count) : taken(count, 0) {}
+
+bool ForkTable::acquire(int left, int right, std::chrono::milliseconds timeout) {
+    std::unique_lock<std::mutex> lock(mutex);
+    if (!cv.wait_for(lock, timeout, [&] { return !taken[left] && !taken[right]; })) {
+        return false;
+    }
+    taken[left] = 1;
+    taken[right] = 1;
+    return true;
+}
+
+void ForkTable::release(int left, int right) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        taken[left] = 0;
+        taken[right] = 0;
+    }
+    cv.notify_all();
+}
+
+DiningTable::DiningTable(const Config& config) : config(config), forks(config.numPhilosophers) {
+    for (int i = 0; i < config.numPhilosophers; i++) {
+        Philosopher phil;
+        phil.id = i;
+        phil.leftFork = i;
+        phil.rightFork = (i + 1) % config.numPhilosophers;
+        phil.eatingCount = 0;
+        phil.thinkingTime = 0;
+        phil.eatingTime = 0;
+        phil.totalActiveTime = 0;
+        phil.totalBlockedTime = 0;
+        philosophers.push_back(phil);
+    }
+}
+
+void DiningTable::printStatus(const char* status, int id) {
+    std::lock_guard<std::mutex> lock(printMutex);
+    std::cout << "Philosopher " << id << " " << status << std::endl;
+}
+
+void DiningTable::philosopherThread(Philosopher& phil) {
+    using Clock = std::chrono::steady_clock;
+
+    while (running) {
+        int thinkingTime = getRandomTime(config.minThinkingTime, config.maxThinkingTime);
+        printStatus("is thinking", phil.id);
+        std::this_thread::sleep_for(std::chrono::milliseconds(thinkingTime));
+
+        auto startTime = Clock::now();
+
+        if (forks.acquire(phil.leftFork, phil.rightFork, std::chrono::milliseconds(config.timeout))) {
+            auto endTime = Clock::now();
+            phil.totalBlockedTime += elapsedMilliseconds(startTime, endTime);
+
+            int eatingTime = getRandomTime(config.minEatingTime, config.maxEatingTime);
+            printStatus("is eating", phil.id);
+            std::this_thread::sleep_for(std::chrono::milliseconds(eatingTime));
+            phil.eatingCount++;
+
+            startTime = Clock::now();
+            phil.totalActiveTime += eatingTime;
+
+            forks.release(phil.leftFork, phil.rightFork);
+
+            endTime = Clock::now();
+            phil.totalActiveTime += elapsedMilliseconds(startTime, endTime);
+        }
+        else {
+            phil.totalBlockedTime += config.timeout;
+            printStatus("couldn't acquire forks", phil.id);
+        }
+    }
+}
+
+void DiningTable::runSimulation() {
+    std::vector<std::thread> threads;
+
+    running = true;
+    for (auto& phil : philosophers) {
+        threads.emplace_back(&DiningTable::philosopherThread, this, std::ref(phil));
+    }
+
+    std::this_thread::sleep_for(std::chrono::seconds(config.simulationTime));
+    running = false;
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
+const int MAX_PHILOSOPHERS = 10;
+
+struct Philosopher {
+    int id;
+    int leftFork;
+    int rightFork;
+    int eatingCount;
+    int thinkingTime;
+    int eatingTime;
+    long long totalActiveTime;
+    long long totalBlockedTime;
+};
+
+struct Config {
+    int numPhilosophers;
+    int simulationTime;
+    int minThinkingTime;
+    int maxThinkingTime;
+    int minEatingTime;
+    int maxEatingTime;
+    int timeout;
+};
+
+// Forks are taken in pairs and all-or-nothing, the same way
+// WaitForMultipleObjects(bWaitAll = TRUE) grabs two mutexes, so a
+// philosopher never holds one fork while waiting for the other.
+class ForkTable {
+public:
+    explicit ForkTable(int count);
+
+    bool acquire(int left, int right, std::chrono::milliseconds timeout);
+    void release(int left, int right);
+
+private:
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::vector<char> taken;
+};
+
+class DiningTable {
+public:
+    explicit DiningTable(const Config& config);
+
+    // Runs every philosopher for config.simulationTime seconds.
+    void runSimulation();
+
+    const Config& getConfig() const { return config; }
+    const std::vector<Philosopher>& getPhilosophers() const { return philosophers; }
+
+private:
+    void philosopherThread(Philosopher& phil);
+    void printStatus(const char* status, int id);
+
+    Config config;
+    std::vector<Philosopher> philosophers;
+    ForkTable forks;
+    std::mutex printMutex;
+    std::atomic<bool> running{ true };
+};